@@ -36,7 +36,8 @@ typedef enum {
   STATE_MAP,
   STATE_LOAD_DIALOG,
   STATE_FINISHED,
-  STATE_REPLAY
+  STATE_REPLAY,
+  STATE_LOADING
 } State;
 
 /* Definitions from dpmi.h */
@@ -77,6 +78,25 @@ void do_render(void);
  */
 void process_timing_stuff(void);
 
+/**
+ * Keeps the picture highlighted in the load dialog prefetched, a step at a
+ * time.
+ *
+ * @note Called once a frame, after input has been handled, so prefetching
+ *       never holds up input.  Nothing is loaded if the next frame is 
+ *       already due.
+ */
+void process_prefetch(void);
+
+/**
+ * Does the next step of loading the picture picked in the load dialog, and
+ * starts the game once it's all in.
+ *
+ * @note Called once a frame in STATE_LOADING.  If the picture can't be
+ *       loaded, the game goes back to the title screen.
+ */
+void process_loading_step(void);
+
 /**
  * Show free DPMI memory (physical + virtual)
  * 
@@ -84,4 +104,19 @@ void process_timing_stuff(void);
  */
 void print_mem_free(void);
 
+/**
+ * Show how picture memory has been handed out (see new_picture())
+ * 
+ * @note Shown on exit if the game was started with -m.
+ */
+void print_picture_arena_stats(void);
+
+/**
+ * Show how long the play area took to redraw each way (see 
+ * benchmark_main_area())
+ * 
+ * @note Shown on exit if the game was started with -b.
+ */
+void print_render_benchmark(void);
+
 #endif
@@ -22,7 +22,9 @@
 #define __GLOBALS_H__
 #include "../include/dampbn.h"
 #include "../include/render.h"
+#include "../include/codec.h"
 #include "../include/util.h"
+#include "../include/cache.h"
 #include "../include/palette.h"
 #include "../include/uiconsts.h"
 #include "../include/input.h"
@@ -31,9 +33,9 @@
 #define LOAD_COLLECTION_ACTIVE   0
 #define LOAD_IMAGE_ACTIVE        1
 
-/* Compression types for dampbm .PIC files */
-#define COMPRESSION_NONE   0
-#define COMPRESSION_RLE    1
+/* How many tiles past each edge of the draw area a tiled (v3) picture
+   keeps decoded, so scrolling doesn't have to wait on the disk */
+#define PIC_TILE_LOOKAHEAD 1
 
 #define MAX_PLAY_AREA_WIDTH  20
 #define MAX_PLAY_AREA_HEIGHT 16
@@ -55,15 +57,79 @@
 /* The internal frame rate of various timers */
 #define FRAME_RATE        30
 
-/* Information about picture files that can be loaded */
-#define MAX_COLLECTIONS 1000
-#define MAX_FILES   1000
+/* Information about picture files that can be loaded.  The lists of 
+   collections and pictures start out this big and double as needed. */
+#define CATALOG_INITIAL_SIZE 64
 #define COLLECTION_PATHSPEC "res/pics/*"
 #define PIC_FILE_DIR "res/pics"
 #define PROGRESS_FILE_DIR "progress"
 
+/* Each collection's progress directory holds an index of the metadata of
+   all of its pictures, so the load dialog doesn't have to open them all */
+#define INDEX_FILE_NAME "collect.idx"
+#define INDEX_VERSION   3
+
+/* The most pictures outside the visible page of the load dialog whose
+   metadata is read in each frame */
+#define METADATA_FILES_PER_FRAME 8
+
+/* The ways the load dialog can sort pictures */
+#define SORT_NAME          0
+#define SORT_SIZE          1
+#define SORT_COLORS        2
+#define SORT_PROGRESS      3
+#define NUM_SORTS          4
+
+/* The picture categories, and the category filter that shows them all */
+#define NUM_CATEGORIES        8
+#define FILTER_ALL_CATEGORIES -1
+
+/* The longest search the load dialog accepts */
+#define SEARCH_QUERY_LENGTH 16
+
+/* Thumbnails for the load dialog are cached alongside the progress files,
+   as <picture name>.thm */
+#define THUMBNAIL_VERSION 1
+
+/* The steps of loading a picture, in order */
+#define LOAD_STEP_HEADER             0
+#define LOAD_STEP_PIXELS             1
+#define LOAD_STEP_SQUARES            2
+#define LOAD_STEP_TRANSPARENCY       3
+#define LOAD_STEP_PROGRESS           4
+#define LOAD_STEP_OVERVIEW           5
+#define LOAD_STEP_DONE               6
+#define LOAD_STEP_FAILED             7
+
+/* The steps of loading a progress file, in order */
+#define PROGRESS_STEP_FILE           0
+#define PROGRESS_STEP_MOVES          1
+#define PROGRESS_STEP_MISTAKES       2
+#define PROGRESS_STEP_JOURNAL        3
+#define PROGRESS_STEP_DONE           4
+#define PROGRESS_STEP_FAILED         5
+
+/* The most squares made from decoded pixels (or decoded, or read from the
+   progress file) in each step of loading, which splits a full size picture
+   over a few frames */
+#define LOAD_SQUARES_PER_STEP    16384
+
+/* Progress journal record types */
+#define JOURNAL_FILL                 1
+#define JOURNAL_ERASE                2
+#define JOURNAL_SAVE                 3
+
+/* Once this many fills and erases have piled up in the progress journal,
+   the next save rewrites the whole progress file instead */
+#define PROGRESS_JOURNAL_MAX_EVENTS  4096
+
 #define CONFIG_FILE "dampbn.cfg"
 
+/* The picture the player was last working on, for the title screen's 
+   'continue' option and the -c command line flag */
+#define SESSION_FILE "dampbn.ses"
+#define SESSION_VERSION 1
+
 #define MOUSE_MODE_NEUTRAL             0
 #define MOUSE_MODE_DRAW                1
 #define MOUSE_MODE_ERASE               2
@@ -125,6 +191,16 @@ extern BITMAP *g_save_notice;
 extern BITMAP *g_load_notice;
 extern BITMAP *g_load_dialog;
 extern BITMAP *g_overview_box;
+/* The current picture at one pixel per square, as shown on the map screen,
+   and whether it's been built for the current picture yet */
+extern BITMAP *g_map_area;
+extern int g_map_area_valid;
+extern BITMAP *g_thumbnail_box;
+
+/* The thumbnail in the load dialog's preview, and the picture it's for */
+extern Thumbnail g_thumbnail;
+extern char g_thumbnail_collection[];
+extern char g_thumbnail_name[];
 extern BITMAP *g_overview_cursor;
 extern BITMAP *g_finished_dialog;
 extern BITMAP *g_mouse_cursor;
@@ -134,9 +210,24 @@ extern BITMAP *g_help_exit;
 extern BITMAP *g_sure;
 extern BITMAP *g_vol_buttons;
 
+/* Every way a square in the play area can be drawn */
+extern SquareAtlas g_square_atlas;
+
 /* The parts of the screen to render */
 extern RenderComponents g_components;
 
+/* The parts of the back buffer drawn to since the display was last updated */
+extern DirtyRect g_dirty_rects[];
+extern int g_num_dirty_rects;
+
+/* What the play area in the back buffer was last drawn from */
+extern DrawnArea g_drawn_area;
+
+/* Whether to time the play area renderer when a picture is opened, and what
+   it found */
+extern int g_benchmark_render;
+extern RenderBench g_render_bench;
+
 /* The currently active Picture */
 extern Picture *g_picture;
 
@@ -258,16 +349,21 @@ extern TitleAnimation g_title_anim;
 /* The Allegro datafile containing image resources */
 extern DATAFILE *g_res;
 
-/* The collections to be displayed in the 'Load file' menu */
-extern CollectionItem g_collection_items[MAX_FILES];
+/* The collections to be displayed in the 'Load file' menu, and how many
+   there's room for */
+extern CollectionItem *g_collection_items;
+extern int g_collection_items_size;
 
-/* The pictures to be displayed in the 'Load file' menu */
-extern PictureItem g_pic_items[MAX_FILES];
+/* The pictures to be displayed in the 'Load file' menu, and how many
+   there's room for */
+extern PictureItem *g_pic_items;
+extern int g_pic_items_size;
 
 /* The actual index of the selected collection in the load file dialog */
 extern int g_load_collection_index;
 
-/* The actual index of the selected picture in the load file dialog */
+/* The row of the selected picture in the load file dialog.  Rows map to
+   pictures through g_pic_view. */
 extern int g_load_picture_index;
 
 /* The index of the category shown at the top of the list */
@@ -291,9 +387,94 @@ extern int g_mouse_selected_load_index;
 /* The number of picture collections available to display */
 extern int g_num_collections;
 
-/* The number of picture files available to display in the Load File menu */
+/* The number of picture files in the current collection */
 extern int g_num_picture_files;
 
+/* Every picture in the current collection, in each of the sort orders.  
+   Sort order k starts at g_pic_sorts + (k * g_num_picture_files). */
+extern int *g_pic_sorts;
+extern int g_pic_sorts_size;
+
+/* The function that compares pictures for each sort order */
+extern int (*g_pic_sort_compare[NUM_SORTS])(const void *, const void *);
+
+/* The pictures shown in the Load File menu (i.e. the ones that pass the
+   filters, in the current sort order), as indexes into g_pic_items */
+extern int *g_pic_view;
+extern int g_pic_view_size;
+extern int g_num_view_pictures;
+
+/* How the Load File menu sorts and filters pictures */
+extern int g_load_sort;
+extern int g_load_category_filter;
+extern int g_load_unfinished_only;
+extern char *g_sort_names[];
+
+/* Index entries for the current collection, and how many of them are still
+   waiting for their metadata to be read */
+extern IndexEntry *g_index_entries;
+extern int g_index_entries_size;
+extern int g_metadata_pending;
+
+/* The picture being loaded in STATE_LOADING */
+extern PictureLoader g_loader;
+
+/* The block of memory the last freed picture used, kept for the next one,
+   and how big it is */
+extern void *g_spare_arena;
+extern long g_spare_arena_size;
+
+/* How picture memory has been handed out, and whether to show that when
+   the game exits */
+extern PictureArenaStats g_arena_stats;
+extern int g_report_memory;
+
+/* Where the player left off last time, whether there's anywhere to go back
+   to, and whether to go straight there on startup */
+extern Session g_session;
+extern int g_session_valid;
+extern int g_resume_on_start;
+
+/* Recently played pictures, how much memory they're using (in bytes), and
+   a counter that goes up every time an entry is touched, for picking the 
+   least recently used one */
+extern CachedPicture g_picture_cache[PICTURE_CACHE_SLOTS];
+extern long g_picture_cache_used;
+extern unsigned long g_picture_cache_clock;
+
+/* How much memory the picture cache can use, in KB (0 = don't cache) */
+extern int g_picture_cache_kb;
+
+/* The picture being prefetched from the load dialog */
+extern Prefetch g_prefetch;
+
+/* The thumbnail being made for the load dialog's preview */
+extern ThumbnailJob g_thumbnail_job;
+
+/* Every picture in every collection, for searching by file name or title */
+extern SearchEntry *g_search_entries;
+extern int g_search_entries_size;
+extern int g_num_search_entries;
+extern int g_search_index_built;
+
+/* The pictures that match the current search, as indexes into 
+   g_search_entries */
+extern int *g_search_results;
+extern int g_search_results_size;
+extern int g_num_search_results;
+
+/* The (lower case) search that found g_search_results, and whether they're
+   still good.  They aren't once the index changes. */
+extern char g_last_search_query[SEARCH_QUERY_LENGTH + 1];
+extern int g_search_results_valid;
+
+/* Whether the load dialog is showing search results, what's been typed so
+   far, and the highlighted result */
+extern int g_load_search_active;
+extern char g_search_query[SEARCH_QUERY_LENGTH + 1];
+extern int g_search_result_index;
+extern int g_search_result_offset;
+
 /* Which section of the load dialog (collection or image) is currently active */
 extern int g_load_section_active;
 
@@ -368,6 +549,15 @@ extern int g_autosave_frequency;
 /* How long until the next autosave */
 extern int g_autosave_counter;
 
+/* Stands in for squares in tiles that couldn't be loaded (see 
+   blank_picture_square()) */
+extern ColorSquare g_blank_square;
+
+/* The progress count of the last save_progress() that the collection index
+   and thumbnail haven't been brought up to date with, or -1 if there isn't
+   one */
+extern int g_unsynced_progress;
+
 /* Should the game automatically save on exit? */
 extern int  g_save_on_exit;
 
@@ -60,6 +60,30 @@ void input_state_title(void);
  */
 void input_state_load_dialog(void);
 
+/**
+ * Process typing, moving through the results and picking one while the
+ * load dialog is searching (g_load_search_active is set)
+ */
+void input_load_dialog_search(void);
+
+/**
+ * Moves the highlight through the load dialog's search results, scrolling
+ * the list if needed.
+ *
+ * @param amount how many results to move by (negative to move up)
+ */
+void move_search_cursor(int amount);
+
+/**
+ * Switches the load dialog to the collection a search result is in, and 
+ * highlights the picture there.
+ *
+ * @param entry the result, as an index into g_search_entries
+ *
+ * @note If the current filters hide the picture, they're cleared.
+ */
+void select_search_result(int entry);
+
 /**
  * Process input for the in game state (g_cur_state = STATE_GAME)
  */
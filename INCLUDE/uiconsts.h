@@ -142,9 +142,15 @@
 #define LOADING_MESSAGE_X          138
 #define LOADING_MESSAGE_Y          146
 
-/* The load picture dialog */
-#define LOAD_DIALOG_X               56
+/* The progress bar under the 'Loading...' message */
+#define LOADING_BAR_GAP              2
+#define LOADING_BAR_HEIGHT           6
+
+/* The load picture dialog.  It sits to the left of the screen to leave 
+   room for the preview of the highlighted picture. */
+#define LOAD_DIALOG_X                6
 #define LOAD_DIALOG_Y               23
+#define LOAD_DIALOG_WIDTH          207
 
 /* Locations of the highlights for the collection and image sections
    of the load dialog */
@@ -220,7 +226,7 @@
 #define LOAD_FILE_PROGRESS_TEXT_X    ((LOAD_DIALOG_X) + 166)   
 #define LOAD_FILE_PROGRESS_TEXT_Y    ((LOAD_DIALOG_Y) + 102)
 
-#define LOAD_FILE_EXTRA_X             59
+#define LOAD_FILE_EXTRA_X            ((LOAD_DIALOG_X) + 3)
 #define LOAD_FILE_EXTRA_Y            166
 
 #define LOAD_FILE_EXTRA_WIDTH        201
@@ -228,9 +234,36 @@
 
 #define LOAD_FILE_EXTRA_CENTER_X (LOAD_FILE_EXTRA_X + (LOAD_FILE_EXTRA_WIDTH / 2))
 
-#define LOAD_RESET_CONFIRM_X          120
+#define LOAD_RESET_CONFIRM_X         ((LOAD_DIALOG_X) + 64)
 #define LOAD_RESET_CONFIRM_Y           87
 
+/* The preview of the highlighted picture, to the right of the load dialog */
+#define LOAD_PREVIEW_X               ((LOAD_DIALOG_X) + (LOAD_DIALOG_WIDTH) + 4)
+#define LOAD_PREVIEW_Y               (LOAD_DIALOG_Y)
+#define LOAD_PREVIEW_WIDTH           (THUMBNAIL_WIDTH + 4)
+#define LOAD_PREVIEW_HEIGHT          (THUMBNAIL_HEIGHT + 15)
+#define LOAD_PREVIEW_TEXT_X          ((LOAD_PREVIEW_X) + (LOAD_PREVIEW_WIDTH / 2))
+#define LOAD_PREVIEW_TEXT_Y          ((LOAD_PREVIEW_Y) + 2)
+#define LOAD_THUMBNAIL_X             ((LOAD_PREVIEW_X) + 2)
+#define LOAD_THUMBNAIL_Y             ((LOAD_PREVIEW_Y) + 13)
+
+/* How the picture list is sorted and filtered, under the preview */
+#define LOAD_VIEW_X                  (LOAD_PREVIEW_X)
+#define LOAD_VIEW_Y                  ((LOAD_PREVIEW_Y) + (LOAD_PREVIEW_HEIGHT) + 2)
+#define LOAD_VIEW_WIDTH              (LOAD_PREVIEW_WIDTH)
+#define LOAD_VIEW_HEIGHT             31
+#define LOAD_VIEW_TEXT_X             ((LOAD_VIEW_X) + 3)
+#define LOAD_VIEW_TEXT_Y             ((LOAD_VIEW_Y) + 2)
+#define LOAD_VIEW_LINE_HEIGHT         9
+
+/* The search box, under the sort order and filters */
+#define LOAD_SEARCH_X                (LOAD_PREVIEW_X)
+#define LOAD_SEARCH_Y                ((LOAD_VIEW_Y) + (LOAD_VIEW_HEIGHT) + 2)
+#define LOAD_SEARCH_WIDTH            (LOAD_PREVIEW_WIDTH)
+#define LOAD_SEARCH_HEIGHT           22
+#define LOAD_SEARCH_TEXT_X           ((LOAD_SEARCH_X) + 3)
+#define LOAD_SEARCH_TEXT_Y           ((LOAD_SEARCH_Y) + 2)
+
 /* Pick the button set depending on whether a button  is pressed or not */
 #define BUTTON_DEFAULT_OFFSET      0
 #define BUTTON_PRESSED_OFFSET      22
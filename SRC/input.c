@@ -762,7 +762,8 @@ void process_scroll_bar_mouse_input(void) {
  *============================================================================*/
 void process_main_area_keyboard_input(void) {
   int square_offset, fill_val, pal_val;
-  int moved, done;
+  int moved, done, result;
+  ColorSquare *square;
 
   moved = 0;
   done = 0;
@@ -938,40 +939,55 @@ void process_main_area_keyboard_input(void) {
     if (!g_keypress_lockout[KEY_SPACE]) {
       square_offset = (g_draw_position_y * g_picture->w) +
                        g_draw_position_x;
-      fill_val = g_picture->pic_squares[square_offset].fill_value;
-      pal_val = g_picture->pic_squares[square_offset].pal_entry;
+      square = picture_square(g_picture, g_draw_position_x,
+                              g_draw_position_y);
+      fill_val = square_fill_value(*square);
+      pal_val = square_pal_entry(*square);
       /* Only process the square if it isn't transparent */
-      if (g_picture->pic_squares[square_offset].is_transparent == 0) {
+      if (square_is_transparent(*square) == 0) {
         /* If unfilled, fill with the active color.  If filled, unfill it,
           but only if it's the incorrect color. */
         if(fill_val != 0) {
           if (fill_val != pal_val) {
-            g_picture->pic_squares[square_offset].fill_value = 0;           
-            g_picture->mistakes[square_offset] = 0;
+            square_set_fill_value(square, 0);           
+            set_picture_mistake(g_picture, square_offset, 0);
             g_mistake_count--;
-            g_picture->pic_squares[square_offset].correct = 0;          
+            square_set_correct(square, 0);          
+            record_progress_event(g_picture, g_draw_position_x,
+                                  g_draw_position_y, JOURNAL_ERASE, 0);
           }
         }   else {
-          g_picture->pic_squares[square_offset].fill_value = g_cur_color;
-          /* Update mistake/progress counters */           
+          /* Record the fill before making it, so running out of memory
+             just leaves the square alone */
           if (g_cur_color != pal_val) {
-            g_picture->mistakes[square_offset] = g_cur_color;
-            g_mistake_count++;
-            g_picture->pic_squares[square_offset].correct = 0;          
+            result = set_picture_mistake(g_picture, square_offset, 
+                                         g_cur_color);
+          } else {
+            result = add_draw_order(g_picture, g_correct_count, 
+                                    g_draw_position_x, g_draw_position_y);
+          }
+          if (result == 0) {
+            square_set_fill_value(square, g_cur_color);
+            record_progress_event(g_picture, g_draw_position_x,
+                                  g_draw_position_y, JOURNAL_FILL, 
+                                  g_cur_color);
+            /* Update mistake/progress counters */           
+            if (g_cur_color != pal_val) {
+              g_mistake_count++;
+              square_set_correct(square, 0);          
+            }
+            else {
+              g_correct_count++;
+              square_set_correct(square, 1);
+              /* Check to see if we're done with the picture */
+              done = check_completion();
+              if (done) {
+                /* Save the file to write out the complete progress */
+                save_progress_file(g_picture);
+                change_state(STATE_FINISHED, STATE_GAME);
+              }   
+            }
           }
-          else {
-            g_picture->draw_order[g_correct_count].x = g_draw_position_x;
-            g_picture->draw_order[g_correct_count].y = g_draw_position_y;
-            g_correct_count++;
-            g_picture->pic_squares[square_offset].correct = 1;
-            /* Check to see if we're done with the picture */
-            done = check_completion();
-            if (done) {
-              /* Save the file to write out the complete progress */
-              save_progress_file(g_picture);
-              change_state(STATE_FINISHED, STATE_GAME);
-            }   
-          }                         
        }
     }
      clear_render_components(&g_components);
@@ -981,6 +997,7 @@ void process_main_area_keyboard_input(void) {
                             (g_draw_position_y - 
                              (g_draw_position_y % OVERVIEW_BLOCK_SIZE)) /
                              OVERVIEW_BLOCK_SIZE);
+     update_map_area_at(g_draw_position_x, g_draw_position_y);
      g_components.render_draw_cursor = 1;
      g_components.render_status_text = 1;
      g_components.render_overview_display = 1;
@@ -1038,6 +1055,7 @@ void process_midi_inputs(void) {
 void process_main_area_mouse_input(void) {
 
   int square_offset, fill_val, pal_val, done;
+  ColorSquare *square;
   Position p;
 
   g_old_mouse_x = g_mouse_x;
@@ -1064,41 +1082,52 @@ void process_main_area_mouse_input(void) {
     g_draw_position_y = g_pic_render_y + g_draw_cursor_y;
     square_offset = (g_draw_position_y * g_picture->w) +
                      g_draw_position_x;
-    fill_val = g_picture->pic_squares[square_offset].fill_value;
-    pal_val = g_picture->pic_squares[square_offset].pal_entry;
+    square = picture_square(g_picture, g_draw_position_x, g_draw_position_y);
+    fill_val = square_fill_value(*square);
+    pal_val = square_pal_entry(*square);
 
     /* If we're in neutral mode and clicking over empty space or correctly 
        filled space, enter draw mode */
     if (mouse_b & 1) {
       if (g_game_area_mouse_mode == MOUSE_MODE_NEUTRAL) {
-        if (fill_val == 0  || (g_picture->pic_squares[square_offset].correct)) {
+        if (fill_val == 0  || square_is_correct(*square)) {
           g_game_area_mouse_mode = MOUSE_MODE_DRAW;
         }
-        else if (!g_picture->pic_squares[square_offset].correct) {
+        else if (!square_is_correct(*square)) {
           g_game_area_mouse_mode = MOUSE_MODE_ERASE;
         }
       }
       /* If in draw mode, draw in the space if it isn't drawn yet.  Skip if the square shouldn't be drawn on */      
-      if (g_game_area_mouse_mode == MOUSE_MODE_DRAW && g_picture->pic_squares[square_offset].is_transparent == 0) {         
+      if (g_game_area_mouse_mode == MOUSE_MODE_DRAW && square_is_transparent(*square) == 0) {         
         /* Update mistake/progress counters */                  
-        if (g_cur_color != pal_val && g_picture->mistakes[square_offset] == 0) {          
-            if(g_picture->pic_squares[square_offset].correct == 0) {
-              g_picture->pic_squares[square_offset].fill_value = g_cur_color;              
-              g_picture->mistakes[square_offset] = g_cur_color;
-              g_mistake_count++;
-              g_picture->pic_squares[square_offset].correct = 0;
+        if (g_cur_color != pal_val && 
+            picture_mistake(g_picture, square_offset) == 0) {          
+            if(square_is_correct(*square) == 0) {
+              /* Running out of memory for the mistake just leaves the 
+                 square alone */
+              if (set_picture_mistake(g_picture, square_offset, 
+                                      g_cur_color) == 0) {
+                square_set_fill_value(square, g_cur_color);              
+                g_mistake_count++;
+                square_set_correct(square, 0);
+                record_progress_event(g_picture, g_draw_position_x,
+                                      g_draw_position_y, JOURNAL_FILL,
+                                      g_cur_color);
+              }
             } 
             else {
-              g_picture->pic_squares[square_offset].correct = 1;              
+              square_set_correct(square, 1);              
             }
         }             
-        if (fill_val == 0 && g_cur_color == pal_val) {
-          g_picture->pic_squares[square_offset].fill_value = g_cur_color;          
-          g_picture->draw_order[g_correct_count].x = g_draw_position_x;
-          g_picture->draw_order[g_correct_count].y = g_draw_position_y;       
-          g_picture->mistakes[square_offset] = 0;
+        if (fill_val == 0 && g_cur_color == pal_val &&
+            add_draw_order(g_picture, g_correct_count, g_draw_position_x,
+                           g_draw_position_y) == 0) {
+          square_set_fill_value(square, g_cur_color);          
+          set_picture_mistake(g_picture, square_offset, 0);
           g_correct_count++;
-          g_picture->pic_squares[square_offset].correct = 1;
+          square_set_correct(square, 1);
+          record_progress_event(g_picture, g_draw_position_x,
+                                g_draw_position_y, JOURNAL_FILL, g_cur_color);
           /* Check to see if we're done with the picture */
           done = check_completion();
           if (done) {
@@ -1109,12 +1138,15 @@ void process_main_area_mouse_input(void) {
         }                     
       }      
       /* If in erase mode, erase the space if it's drawn incorrectly.  Skip the square if it shouldn't be drawn on */      
-      if (g_game_area_mouse_mode == MOUSE_MODE_ERASE && g_picture->pic_squares[square_offset].is_transparent == 0) {
-        if (!g_picture->pic_squares[square_offset].correct && g_picture->mistakes[square_offset] != 0) {
-          g_picture->pic_squares[square_offset].fill_value = 0;           
-          g_picture->mistakes[square_offset] = 0;
-          g_picture->pic_squares[square_offset].correct = 0;
+      if (g_game_area_mouse_mode == MOUSE_MODE_ERASE && square_is_transparent(*square) == 0) {
+        if (!square_is_correct(*square) && 
+            picture_mistake(g_picture, square_offset) != 0) {
+          square_set_fill_value(square, 0);           
+          set_picture_mistake(g_picture, square_offset, 0);
+          square_set_correct(square, 0);
           g_mistake_count--;
+          record_progress_event(g_picture, g_draw_position_x,
+                                g_draw_position_y, JOURNAL_ERASE, 0);
         }
       }      
       clear_render_components(&g_components);
@@ -1124,6 +1156,7 @@ void process_main_area_mouse_input(void) {
                              (g_draw_position_y - 
                               (g_draw_position_y % OVERVIEW_BLOCK_SIZE)) /
                               OVERVIEW_BLOCK_SIZE);                       
+      update_map_area_at(g_draw_position_x, g_draw_position_y);
     }      
     g_components.render_draw_cursor = 1;
     g_components.render_status_text = 1;
@@ -1268,18 +1301,26 @@ void input_state_help(void) {
  *============================================================================*/
 void input_state_load_dialog(void) {
     char name[80];
+    int category;
+    PictureItem *item;
+
+    /* Searching takes over the keyboard until it's done */
+    if (g_load_search_active) {
+      input_load_dialog_search();
+      return;
+    }
+
+    item = get_selected_picture();
 
     if (key[KEY_ENTER]) {
       if (!g_keypress_lockout[KEY_ENTER]) {
         /* Only load an image if the image side is highlighted */
-        if (g_load_section_active == LOAD_IMAGE_ACTIVE) {
+        if (g_load_section_active == LOAD_IMAGE_ACTIVE && item != NULL) {
           /* If the image isn't complete, then load it */
-          if (g_pic_items[g_load_picture_index].progress < 
-              g_pic_items[g_load_picture_index].total) {
-            strncpy(g_picture_file_basename, 
-                    g_pic_items[g_load_picture_index].name, 8);
+          if (item->progress < item->total) {
+            strncpy(g_picture_file_basename, item->name, 8);
             g_load_new_file = 1;
-            change_state(STATE_GAME, STATE_LOAD_DIALOG);
+            change_state(STATE_LOADING, STATE_LOAD_DIALOG);
           }
         }
         g_keypress_lockout[KEY_ENTER] = 1;          
@@ -1306,7 +1347,7 @@ void input_state_load_dialog(void) {
     if (key[KEY_RIGHT]) {
       if (!g_keypress_lockout[KEY_RIGHT]) {
         if (g_load_section_active == LOAD_COLLECTION_ACTIVE &&
-            g_num_picture_files > 0) {
+            g_num_view_pictures > 0) {
           g_load_section_active = LOAD_IMAGE_ACTIVE;
         } 
       }
@@ -1320,7 +1361,7 @@ void input_state_load_dialog(void) {
     if (key[KEY_TAB]) {
       if (!g_keypress_lockout[KEY_TAB]) {
         if (g_load_section_active == LOAD_COLLECTION_ACTIVE &&
-            g_num_picture_files > 0) {
+            g_num_view_pictures > 0) {
           g_load_section_active = LOAD_IMAGE_ACTIVE;
         } else {
           g_load_section_active = LOAD_COLLECTION_ACTIVE;
@@ -1350,11 +1391,15 @@ void input_state_load_dialog(void) {
     /* Y confirms the progress reset, but only if the dialog is displayed */
     if (key[KEY_Y]) {
       if (!g_keypress_lockout[KEY_Y]) {
-        if (g_load_action_confirm) {
-          sprintf(name, "%s/%s/%s.pro", PROGRESS_FILE_DIR, g_collection_name, g_pic_items[g_load_picture_index].name);          
+        if (g_load_action_confirm && item != NULL) {
+          sprintf(name, "%s/%s/%s.pro", PROGRESS_FILE_DIR, g_collection_name, item->name);          
           delete_progress_file(name);
-          /* Reset the progress */
-          g_pic_items[g_load_picture_index].progress = 0;
+          drop_cached_picture(g_collection_name, item->name);
+          cancel_prefetch();
+          /* Reset the progress, which can move it in the list */
+          item->progress = 0;
+          resort_picture(item - g_pic_items);
+          update_picture_view();
           g_load_action_confirm = 0;
         }
         g_keypress_lockout[KEY_Y] = 1;   
@@ -1381,7 +1426,7 @@ void input_state_load_dialog(void) {
     if (key[KEY_R]) {
       if (!g_keypress_lockout[KEY_R]) {
         /* But only if there's progress */
-        if (g_pic_items[g_load_picture_index].progress > 0) {
+        if (item != NULL && item->progress > 0) {
           g_load_action_confirm = 1;
         }
         g_keypress_lockout[KEY_R] = 1;              
@@ -1394,11 +1439,12 @@ void input_state_load_dialog(void) {
     /* P does a replay */
     if (key[KEY_P]) {
       if (!g_keypress_lockout[KEY_P]) {
-        strncpy(g_picture_file_basename, 
-                g_pic_items[g_load_picture_index].name, 8);
-        g_load_new_file = 1;
-        change_state(STATE_REPLAY, STATE_LOAD_DIALOG);     
-        g_replay_from_load_screen = 1;   
+        if (item != NULL) {
+          strncpy(g_picture_file_basename, item->name, 8);
+          g_load_new_file = 1;
+          change_state(STATE_REPLAY, STATE_LOAD_DIALOG);     
+          g_replay_from_load_screen = 1;   
+        }
         g_keypress_lockout[KEY_P] = 1;
       }
     }
@@ -1406,6 +1452,62 @@ void input_state_load_dialog(void) {
       g_keypress_lockout[KEY_P] = 0;
     } 
 
+    /* S changes how the pictures are sorted */
+    if (key[KEY_S]) {
+      if (!g_keypress_lockout[KEY_S]) {
+        set_picture_view((g_load_sort + 1) % NUM_SORTS, 
+                         g_load_category_filter, g_load_unfinished_only);
+        g_keypress_lockout[KEY_S] = 1;
+      }
+    }
+    if (!key[KEY_S] && g_keypress_lockout[KEY_S]) {
+      g_keypress_lockout[KEY_S] = 0;
+    } 
+
+    /* C steps through showing all categories, then each one on its own */
+    if (key[KEY_C]) {
+      if (!g_keypress_lockout[KEY_C]) {
+        category = g_load_category_filter + 1;
+        if (category >= NUM_CATEGORIES || g_categories[category] == NULL)
+          category = FILTER_ALL_CATEGORIES;
+        set_picture_view(g_load_sort, category, g_load_unfinished_only);
+        g_keypress_lockout[KEY_C] = 1;
+      }
+    }
+    if (!key[KEY_C] && g_keypress_lockout[KEY_C]) {
+      g_keypress_lockout[KEY_C] = 0;
+    } 
+
+    /* U hides or shows completed pictures */
+    if (key[KEY_U]) {
+      if (!g_keypress_lockout[KEY_U]) {
+        set_picture_view(g_load_sort, g_load_category_filter, 
+                         !g_load_unfinished_only);
+        g_keypress_lockout[KEY_U] = 1;
+      }
+    }
+    if (!key[KEY_U] && g_keypress_lockout[KEY_U]) {
+      g_keypress_lockout[KEY_U] = 0;
+    } 
+
+    /* F starts a search of every collection */
+    if (key[KEY_F]) {
+      if (!g_keypress_lockout[KEY_F]) {
+        g_load_search_active = 1;
+        g_load_action_confirm = 0;
+        g_search_query[0] = '\0';
+        search_pictures(g_search_query);
+        g_search_result_index = 0;
+        g_search_result_offset = 0;
+        /* Don't let the F itself end up in the search */
+        clear_keybuf();
+        g_keypress_lockout[KEY_F] = 1;
+      }
+    }
+    if (!key[KEY_F] && g_keypress_lockout[KEY_F]) {
+      g_keypress_lockout[KEY_F] = 0;
+    } 
+
     /* Need the following */
     /* index - the actual value of the picture to load */
     /* offset - the index of the top position on the dialog */
@@ -1545,6 +1647,126 @@ void input_state_load_dialog(void) {
     process_load_screen_mouse_input();
 }
 
+/*=============================================================================
+ * input_load_dialog_search
+ *============================================================================*/
+void input_load_dialog_search(void) {
+  int k, length;
+
+  /* Typed text comes from the keyboard buffer rather than key[], so 
+     characters repeat and shift works the way they do everywhere else */
+  while (keypressed()) {
+    k = readkey();
+    length = strlen(g_search_query);
+
+    switch (k >> 8) {
+      case KEY_ESC:
+        g_load_search_active = 0;
+        /* Don't let the same keypress close the dialog too */
+        g_keypress_lockout[KEY_ESC] = 1;
+        clear_keybuf();
+        return;
+      case KEY_ENTER:
+        if (g_num_search_results > 0)
+          select_search_result(g_search_results[g_search_result_index]);
+        g_load_search_active = 0;
+        /* Or load the picture */
+        g_keypress_lockout[KEY_ENTER] = 1;
+        clear_keybuf();
+        return;
+      case KEY_BACKSPACE:
+        if (length > 0) {
+          g_search_query[length - 1] = '\0';
+          search_pictures(g_search_query);
+          g_search_result_index = 0;
+          g_search_result_offset = 0;
+        }
+        break;
+      case KEY_UP:
+        move_search_cursor(-1);
+        break;
+      case KEY_DOWN:
+        move_search_cursor(1);
+        break;
+      case KEY_PGUP:
+        move_search_cursor(-LOAD_NUM_VISIBLE_FILES);
+        break;
+      case KEY_PGDN:
+        move_search_cursor(LOAD_NUM_VISIBLE_FILES);
+        break;
+      default:
+        if ((k & 0xff) >= ' ' && (k & 0xff) <= '~' && 
+            length < SEARCH_QUERY_LENGTH) {
+          g_search_query[length] = k & 0xff;
+          g_search_query[length + 1] = '\0';
+          search_pictures(g_search_query);
+          g_search_result_index = 0;
+          g_search_result_offset = 0;
+        }
+        break;
+    }
+  }
+}
+
+/*=============================================================================
+ * move_search_cursor
+ *============================================================================*/
+void move_search_cursor(int amount) {
+  g_search_result_index += amount;
+  if (g_search_result_index >= g_num_search_results)
+    g_search_result_index = g_num_search_results - 1;
+  if (g_search_result_index < 0)
+    g_search_result_index = 0;
+
+  if (g_search_result_index < g_search_result_offset)
+    g_search_result_offset = g_search_result_index;
+  if (g_search_result_index >= g_search_result_offset + LOAD_NUM_VISIBLE_FILES)
+    g_search_result_offset = g_search_result_index - LOAD_NUM_VISIBLE_FILES + 1;
+}
+
+/*=============================================================================
+ * select_search_result
+ *============================================================================*/
+void select_search_result(int entry) {
+  char name[9];
+  int i, row;
+
+  /* Reading the collection can change the search index, so hang on to the 
+     name rather than the entry */
+  memcpy(name, g_search_entries[entry].name, 9);
+
+  for (i = 0; i < g_num_collections; i++) {
+    if (strncmp(g_collection_items[i].name, 
+                g_search_entries[entry].collection, 8) == 0)
+      break;
+  }
+  if (i == g_num_collections)
+    return;
+
+  g_load_collection_index = i;
+  g_load_collection_cursor_offset = (i < LOAD_NUM_VISIBLE_FILES) ? 
+                                    i : LOAD_NUM_VISIBLE_FILES - 1;
+  g_load_collection_offset = i - g_load_collection_cursor_offset;
+  get_picture_files(g_collection_items[i].name);
+
+  row = find_picture_row(name);
+  if (row < 0 && (g_load_category_filter != FILTER_ALL_CATEGORIES ||
+                  g_load_unfinished_only)) {
+    set_picture_view(g_load_sort, FILTER_ALL_CATEGORIES, 0);
+    row = find_picture_row(name);
+  }
+  if (row < 0) {
+    g_load_section_active = LOAD_COLLECTION_ACTIVE;
+    return;
+  }
+
+  g_load_picture_index = row;
+  g_load_cursor_offset = (row < LOAD_NUM_VISIBLE_FILES) ? 
+                         row : LOAD_NUM_VISIBLE_FILES - 1;
+  g_load_picture_offset = row - g_load_cursor_offset;
+  g_load_section_active = LOAD_IMAGE_ACTIVE;
+}
+
 /* calculate_new_load_item_positions */
 void calculate_new_load_item_positions(int direction, int amount, int which) {
   int adj_offset;
@@ -1622,8 +1844,8 @@ void calculate_new_load_item_positions(int direction, int amount, int which) {
       }
       else if (which == MOVE_IMAGE) {
         g_load_picture_index++;
-        if (g_load_picture_index >= g_num_picture_files) {
-          g_load_picture_index = g_num_picture_files -1;
+        if (g_load_picture_index >= g_num_view_pictures) {
+          g_load_picture_index = g_num_view_pictures -1;
         }
         else {
           g_load_cursor_offset++;
@@ -1660,15 +1882,15 @@ void calculate_new_load_item_positions(int direction, int amount, int which) {
         g_load_collection_index = g_load_collection_offset + g_load_collection_cursor_offset;
       }
       else if (which == MOVE_IMAGE) {
-        if (g_num_picture_files < LOAD_NUM_VISIBLE_FILES) {
+        if (g_num_view_pictures < LOAD_NUM_VISIBLE_FILES) {
           g_load_picture_offset = 0;
-          g_load_cursor_offset = g_num_picture_files - 1;
+          g_load_cursor_offset = g_num_view_pictures - 1;
         }
         else {
           g_load_picture_offset = g_load_picture_offset + LOAD_NUM_VISIBLE_FILES;
-          if (g_load_picture_offset > g_num_picture_files - LOAD_NUM_VISIBLE_FILES) {
-            adj_offset = g_load_picture_offset - (g_num_picture_files - LOAD_NUM_VISIBLE_FILES);
-            g_load_picture_offset = (g_num_picture_files - LOAD_NUM_VISIBLE_FILES);
+          if (g_load_picture_offset > g_num_view_pictures - LOAD_NUM_VISIBLE_FILES) {
+            adj_offset = g_load_picture_offset - (g_num_view_pictures - LOAD_NUM_VISIBLE_FILES);
+            g_load_picture_offset = (g_num_view_pictures - LOAD_NUM_VISIBLE_FILES);
             g_load_cursor_offset = g_load_cursor_offset + adj_offset;
            if (g_load_cursor_offset >= LOAD_NUM_VISIBLE_FILES) {
               g_load_cursor_offset = LOAD_NUM_VISIBLE_FILES - 1;
@@ -1688,6 +1910,7 @@ void process_load_screen_mouse_input(void) {
   int category_scrollbar_end = category_scrollbar_begin + g_collection_scrollbar_height;
   int cur_offset;
   int update = 0;
+  PictureItem *item;
 
   /* Get the mouse info */
   g_old_mouse_x = g_mouse_x;
@@ -1746,30 +1969,31 @@ void process_load_screen_mouse_input(void) {
   /* If clicked, highlight the appropriate entry*/
   if (mouse_clicked_here(IMAGE_HIGHLIGHT_X_OFF + 1, IMAGE_HIGHLIGHT_Y_OFF + 1, IMAGE_HIGHLIGHT_X_OFF + IMAGE_HIGHLIGHT_WIDTH -1, IMAGE_HIGHLIGHT_Y_OFF + IMAGE_HIGHLIGHT_HEIGHT - 1, 1)) {
           if (g_load_section_active == LOAD_COLLECTION_ACTIVE &&
-              g_num_picture_files > 0) {
+              g_num_view_pictures > 0) {
             g_load_section_active = LOAD_IMAGE_ACTIVE;
             g_mouse_selected_load_index = -1;
           }
           // Assign the item on the list closest to where the mouse clicked.
           cur_offset = (g_mouse_y - LOAD_FILE_NAME_Y_OFF) / LOAD_FILE_NAME_HEIGHT;
-          if (cur_offset + g_load_picture_offset > g_num_picture_files - 1) {
-            cur_offset = (g_num_picture_files - 1) - g_load_picture_offset;
+          if (cur_offset + g_load_picture_offset > g_num_view_pictures - 1) {
+            cur_offset = (g_num_view_pictures - 1) - g_load_picture_offset;
           }
+          if (cur_offset < 0)
+            cur_offset = 0;
           g_load_cursor_offset = cur_offset;
           g_load_picture_index = g_load_picture_offset + g_load_cursor_offset;
-          if (g_load_picture_index == g_mouse_selected_load_index) {
+          item = get_selected_picture();
+          if (item != NULL && 
+              g_load_picture_index == g_mouse_selected_load_index) {
             /* If the image isn't complete, then load it */
-            if (g_pic_items[g_load_picture_index].progress < 
-                g_pic_items[g_load_picture_index].total) {
-              strncpy(g_picture_file_basename, 
-                      g_pic_items[g_load_picture_index].name, 8);
+            if (item->progress < item->total) {
+              strncpy(g_picture_file_basename, item->name, 8);
               g_load_new_file = 1;
-              change_state(STATE_GAME, STATE_LOAD_DIALOG);
+              change_state(STATE_LOADING, STATE_LOAD_DIALOG);
             } 
             /* If the image is complete, then replay it */
             else {
-              strncpy(g_picture_file_basename, 
-                      g_pic_items[g_load_picture_index].name, 8);
+              strncpy(g_picture_file_basename, item->name, 8);
               g_load_new_file = 1;
               change_state(STATE_REPLAY, STATE_LOAD_DIALOG);     
               g_replay_from_load_screen = 1;
@@ -2037,6 +2261,24 @@ void input_state_title(void) {
     g_keypress_lockout[KEY_ENTER] = 0;
   }      
 
+  /* C goes straight back to the last picture played */
+  if (key[KEY_C]) {
+    if(!g_keypress_lockout[KEY_C]) {
+      if (g_session_valid && resume_session() == 0) {
+        g_midi_is_playing = 0;
+        change_state(STATE_GAME, STATE_TITLE);
+      } else {
+        /* Whatever was there is gone, so stop offering it */
+        g_session_valid = 0;
+        g_title_anim.update_background = 1;
+      }
+      g_keypress_lockout[KEY_C] = 1;
+    }
+  }
+  if (!key[KEY_C] && g_keypress_lockout[KEY_C]) {
+    g_keypress_lockout[KEY_C] = 0;
+  }      
+
   if (key[KEY_ESC]) {
     if (!g_keypress_lockout[KEY_ESC]) {
         g_game_done = 1;      
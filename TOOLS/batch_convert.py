@@ -7,6 +7,13 @@
 # The tool takes 5 command line arguments; an input directory, an output directory, a path to a CSV file
 # containing information about each of the images, an argument that specifies the kind of compression to be used,
 # and an argument specifing whether files should be created using the v2 format (with transparency)
+#
+# Compression types are 0 (none), 1 (RLE), 2 (LZ77) or 3 (auto - pick whichever of the others is smallest).  The
+# first three match the values stored in the picture header.
+#
+# An optional 6th argument of "1" writes tiled (v3) files instead.  Tiled files are split into independently
+# compressed 32x32 tiles that the game decodes on demand, so images are not scaled down to 320x200 in this mode.
+# Auto compression then compares the total size of the compressed tiles.
 
 # About the CSV file:
 #
@@ -26,6 +33,21 @@ import sys, os, PIL.Image
 # If True, also writes a copy of the converted image as a PNG for inspection
 debug_output = False
 
+# Tiles in v3 files are 2^TILE_SHIFT squares on a side
+TILE_SHIFT = 5
+TILE_SIZE = 1 << TILE_SHIFT
+
+# Compression types as stored in the picture header
+COMPRESSION_NONE = 0
+COMPRESSION_RLE = 1
+COMPRESSION_LZ77 = 2
+
+# LZ77 encoder settings - these must match SRC/CODEC.C so both tools write identical files.  Matches
+# can reach back LZ77_WINDOW bytes, and at most LZ77_MAX_CHAIN earlier candidates are checked.
+LZ77_MIN_MATCH = 3
+LZ77_WINDOW = 4096
+LZ77_MAX_CHAIN = 64
+
 def resize(input_file):
     # Get the width and height of the image
     width, height = input_file.size
@@ -78,6 +100,140 @@ def run_length_encode(data):
         i += repeat_count
     return output_data
 
+def encode_varint(value):
+    # 7 bits at a time, low bits first, with the top bit set on every byte but the last
+    output_data = []
+    while value >= 0x80:
+        output_data.append(0x80 | (value & 0x7F))
+        value >>= 7
+    output_data.append(value)
+    return output_data
+
+def lz77_encode(data):
+    # Greedy LZ77 encoding.  The output is a series of tokens:
+    #  - 0x00-0x7F: (token + 1) literal bytes follow
+    #  - 0x80-0xFF: copy (token & 0x7F) + 3 bytes from earlier in the output.  If the low 7 bits are
+    #    all set, a varint with extra length follows.  Then comes the distance back, as a varint.
+    # At each position, the most recent LZ77_MAX_CHAIN places within LZ77_WINDOW bytes that start
+    # with the same 3 bytes are checked, and the longest match wins.
+    output_data = []
+    chains = {}
+    count = len(data)
+
+    def add_position(pos):
+        if pos + LZ77_MIN_MATCH <= count:
+            chains.setdefault(tuple(data[pos:pos + LZ77_MIN_MATCH]), []).append(pos)
+
+    def flush_literals(start, end):
+        while start < end:
+            n = min(end - start, 128)
+            output_data.append(n - 1)
+            output_data.extend(data[start:start + n])
+            start += n
+
+    pos = 0
+    literal_start = 0
+    while pos < count:
+        best_len = 0
+        best_dist = 0
+        if pos + LZ77_MIN_MATCH <= count:
+            candidates = chains.get(tuple(data[pos:pos + LZ77_MIN_MATCH]), [])
+            depth = 0
+            for candidate in reversed(candidates):
+                if pos - candidate > LZ77_WINDOW or depth >= LZ77_MAX_CHAIN:
+                    break
+                depth += 1
+                length = LZ77_MIN_MATCH
+                while pos + length < count and data[candidate + length] == data[pos + length]:
+                    length += 1
+                if length > best_len:
+                    best_len = length
+                    best_dist = pos - candidate
+                    if pos + length == count:
+                        break
+
+        if best_len < LZ77_MIN_MATCH:
+            add_position(pos)
+            pos += 1
+            continue
+
+        flush_literals(literal_start, pos)
+        length = best_len - LZ77_MIN_MATCH
+        if length < 0x7F:
+            output_data.append(0x80 | length)
+        else:
+            output_data.append(0xFF)
+            output_data.extend(encode_varint(length - 0x7F))
+        output_data.extend(encode_varint(best_dist))
+        for i in range(best_len):
+            add_position(pos)
+            pos += 1
+        literal_start = pos
+
+    flush_literals(literal_start, count)
+    return output_data
+
+def encode_plane(data, compression):
+    # Encode a list of pixel values with the given compression type
+    if compression == COMPRESSION_RLE:
+        return run_length_encode(data)
+    elif compression == COMPRESSION_LZ77:
+        return lz77_encode(data)
+    return data
+
+def get_tile(data, width, height, tx, ty):
+    # Cut a TILE_SIZE x TILE_SIZE tile out of a row-major list of pixels.  Parts of the tile that hang
+    # off the edge of the image are filled with zeroes.
+    tile = []
+    for y in range(ty * TILE_SIZE, (ty + 1) * TILE_SIZE):
+        for x in range(tx * TILE_SIZE, (tx + 1) * TILE_SIZE):
+            if x < width and y < height:
+                tile.append(data[y * width + x])
+            else:
+                tile.append(0)
+    return tile
+
+def tiles_size(width, height, pixel_data, alpha_pixels, compression):
+    # Work out how many bytes the tile data (not counting the index) takes up with the given compression type
+    tiles_w = (width + TILE_SIZE - 1) // TILE_SIZE
+    tiles_h = (height + TILE_SIZE - 1) // TILE_SIZE
+    size = 0
+    for ty in range(tiles_h):
+        for tx in range(tiles_w):
+            size = size + len(encode_plane(get_tile(pixel_data, width, height, tx, ty), compression))
+            if alpha_pixels:
+                size = size + len(encode_plane(get_tile(alpha_pixels, width, height, tx, ty), compression))
+    return size
+
+def write_tiles(output_file, width, height, pixel_data, alpha_pixels, compression):
+    # Write the tile index followed by each tile's pixel data (and transparency data, if there is any).
+    # The index holds the file offset of every tile, plus one more for the end of the last tile.
+    tiles_w = (width + TILE_SIZE - 1) // TILE_SIZE
+    tiles_h = (height + TILE_SIZE - 1) // TILE_SIZE
+    num_tiles = tiles_w * tiles_h
+
+    offset = output_file.tell() + (num_tiles + 1) * 4
+    offsets = []
+    tile_data = []
+    for ty in range(tiles_h):
+        for tx in range(tiles_w):
+            data = get_tile(pixel_data, width, height, tx, ty)
+            if alpha_pixels:
+                alpha = get_tile(alpha_pixels, width, height, tx, ty)
+            else:
+                alpha = []
+            data = encode_plane(data, compression)
+            alpha = encode_plane(alpha, compression)
+            offsets.append(offset)
+            tile_data.append(bytes(data) + bytes(alpha))
+            offset = offset + len(data) + len(alpha)
+    offsets.append(offset)
+
+    for tile_offset in offsets:
+        output_file.write(tile_offset.to_bytes(4, byteorder="little"))
+    for data in tile_data:
+        output_file.write(data)
+
 def get_used_colors(color_data):
     # Given a list of RGB triplets, count the number of unique triplets are in the list and return the count
 
@@ -108,6 +264,7 @@ def main():
     metadata_file = sys.argv[3]
     compression_type = sys.argv[4]
     use_transparency = sys.argv[5]
+    tiled = len(sys.argv) > 6 and sys.argv[6] == "1"
 
     # Get a list of all files in the input directory with the extension .pcx, .jpg, or .png
     input_files = [file for file in os.listdir(input_dir) if file.endswith(".pcx") or file.endswith(".jpg") or file.endswith(".png")]
@@ -131,8 +288,9 @@ def main():
         # Use PIL to open the file
         image = PIL.Image.open(os.path.join(input_dir, file))
 
-        # resize it if needed
-        image = resize(image)
+        # resize it if needed.  Tiled files can be any size.
+        if not tiled:
+            image = resize(image)
 
         # if the image has a palette or is grayscale, we'll still convert to RGB/RGBA depending on if
         # it has a alpha channel or not
@@ -272,23 +430,36 @@ def main():
         # Write the displayed name to the file
         output_file.write(bytes(displayed_name, "ascii"))
 
-        rle_data = run_length_encode(pixel_data)
+        if use_transparency == "1":
+            alpha_pixels = list(alpha_channel.getdata())
+        else:
+            alpha_pixels = []
 
-        write_rle = False
+        compression = COMPRESSION_NONE
         if compression_type == "1":
-            write_rle = True
+            compression = COMPRESSION_RLE
         elif compression_type == "2":
-            if len(rle_data) < len(pixel_data):
-                write_rle = True
-
+            compression = COMPRESSION_LZ77
+        elif compression_type == "3":
+            # Pick whichever compression gives the smallest image and transparency data.  Tiles are compressed
+            # separately, so in tiled mode compare what the tiles add up to.
+            if tiled:
+                best_size = tiles_size(width, height, pixel_data, alpha_pixels, COMPRESSION_NONE)
+            else:
+                best_size = len(pixel_data) + len(alpha_pixels)
+            for candidate in (COMPRESSION_RLE, COMPRESSION_LZ77):
+                if tiled:
+                    size = tiles_size(width, height, pixel_data, alpha_pixels, candidate)
+                else:
+                    size = len(encode_plane(pixel_data, candidate)) + len(encode_plane(alpha_pixels, candidate))
+                if size < best_size:
+                    best_size = size
+                    compression = candidate
 
         # Write the number of colors in the palette to the file
         output_file.write(num_colors.to_bytes(1, byteorder="little"))
-     
-        if write_rle == True:
-            output_file.write(b"\x01")
-        else:
-            output_file.write(b"\x00")
+        # Write the compression type
+        output_file.write(compression.to_bytes(1, byteorder="little"))
 
         # divide all values in the palette by 4
         for i in range(0, len(palette)):
@@ -303,6 +474,22 @@ def main():
                 for i in range(alpha_channel.width):
                     if alpha_channel.getpixel((i, j)) != 0:
                         num_playable_squares = num_playable_squares + 1
+        else:
+            num_playable_squares = width * height
+
+        if tiled:
+            # Write the transparency flag, 2 0 bytes, the version (3), the tile size, the number of
+            # non-transparent squares as 4 bytes and 14 0 bytes to the file
+            if use_transparency == "1":
+                output_file.write(b"\x01")
+            else:
+                output_file.write(b"\x00")
+            output_file.write(b"\x00" * 2)
+            output_file.write(b"\x03")
+            output_file.write(TILE_SHIFT.to_bytes(1, byteorder="little"))
+            output_file.write(num_playable_squares.to_bytes(4, byteorder="little"))
+            output_file.write(b"\x00" * 14)
+        elif use_transparency == "1":
             # Write the transparency flag, non-transparent_squares and 22 0 bytes to the file
             output_file.write(b"\x01")
             output_file.write(num_playable_squares.to_bytes(2, byteorder="little"))
@@ -311,18 +498,11 @@ def main():
             # Write 23 0 bytes to the file
             output_file.write(b"\x00" * 23)
 
-        if write_rle == False:
-            output_file.write(bytes(pixel_data))
+        if tiled:
+            write_tiles(output_file, width, height, pixel_data, alpha_pixels, compression)
         else:
-            output_file.write(bytes(rle_data))
-
-        if use_transparency == "1":
-            alpha_pixels = list(alpha_channel.getdata())
-            if write_rle == False:
-                output_file.write(bytes(alpha_pixels))
-            else:
-                alpha_rle_pixels = run_length_encode(alpha_pixels)
-                output_file.write(bytes(alpha_rle_pixels))
+            output_file.write(bytes(encode_plane(pixel_data, compression)))
+            output_file.write(bytes(encode_plane(alpha_pixels, compression)))
 
         # Close the file
         output_file.close()
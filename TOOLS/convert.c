@@ -21,7 +21,9 @@
 #include <allegro.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "../include/palette.h"
+#include "../include/codec.h"
 
 /* Some stuff to cut down the executable size */
 BEGIN_GFX_DRIVER_LIST
@@ -39,62 +41,153 @@ END_COLOR_DEPTH_LIST
  *           the file format.
  *           
  * Usage: convert <input_file> <output_file> <category_id> <title>
- *                <palette_size> <compression> 
+ *                <palette_size> <compression> [tiled]
  *
  * Example: convert image1.pcx image1.pic 0 "Test Image" 64 1
  *
- * Values for compression:
+ * Values for compression (0-2 match the type stored in the header):
  *  0 - uncompressed
  *  1 - RLE
- *  2 - auto - try both and pick the smallest
+ *  2 - LZ77
+ *  3 - auto - try all of them and pick the smallest
+ *
+ * If tiled is 1, a v3 file is written instead.  The image is split into 
+ * TILE_SIZE x TILE_SIZE tiles that are compressed separately, so the game 
+ * only has to decode the parts of a large image that are on screen.  Auto
+ * compression then compares the total size of the tiles, since that's what
+ * ends up in the file.
  */
 
-/* 
- * get_rle_size()
+/* Tiles in v3 files are 2^TILE_SHIFT squares on a side */
+#define TILE_SHIFT 5
+#define TILE_SIZE  (1 << TILE_SHIFT)
+
+/*
+ * write_plane()
  *
- * Quick and dirty function to calculate the size of data we'd get if we used
- * RLE encoding.  That way, if we set up auto detection of compression, we 
- * can choose whether to use compressed or uncompressed data.
+ * Writes a block of pixel data using the given compression type (the value
+ * stored in the header), and returns the number of bytes written.
+ */
+int write_plane(FILE *fp, unsigned char *data, int count, int compression) {
+  unsigned char *out;
+  int size;
+
+  out = (unsigned char *)malloc(MAX_ENCODED_SIZE(count));
+  size = encode_picture_plane(data, count, compression, out,
+                              MAX_ENCODED_SIZE(count));
+  if (size < 0) {
+    printf("Unable to compress image data!\n");
+    free(out);
+    allegro_exit();
+    exit(1);
+  }
+  fwrite(out, 1, size, fp);
+  free(out);
+
+  return size;
+}
+
+/*
+ * plane_size()
  *
- * Yes, this code is pretty much copy-pasted from main().
+ * Returns the number of bytes a block of pixel data would take up with the
+ * given compression type, or -1 if it can't be encoded.
  */
-int get_rle_size(BITMAP *b) {
-  int cur_val, run_val, run_count, pixel_count, size;
-
-  pixel_count = 0;
-  run_count = 0;
-  size = 0;
-
-  /* Loop until we've gone through all of the pixels */
-  while(pixel_count < b->w * b->h) {
-    run_count = 0;
-    /* Convert a linear count to an x, y coordinate and get the pixel */
-    cur_val = getpixel(b, (pixel_count % b->w), (pixel_count / b->w));
-    run_val = cur_val;
-    /* The RLE encoder shouldn't save color indices higher than 64 */
-    if(run_val >=64) {
-      printf("Invalid index for palette!  All colors must be between 0-63!\n");
-      printf("Run value detected is %d\n", run_val);
-      allegro_exit();
-      exit(1);
+int plane_size(unsigned char *data, int count, int compression) {
+  unsigned char *out;
+  int size;
+
+  out = (unsigned char *)malloc(MAX_ENCODED_SIZE(count));
+  if (out == NULL)
+    return -1;
+  size = encode_picture_plane(data, count, compression, out,
+                              MAX_ENCODED_SIZE(count));
+  free(out);
+
+  return size;
+}
+
+/*
+ * get_tile()
+ *
+ * Copies tile (tx, ty) of the image into tile.  Each tile is 
+ * TILE_SIZE x TILE_SIZE squares; parts of edge tiles that hang off the 
+ * image are filled with color 0.
+ */
+void get_tile(BITMAP *b, int tx, int ty, unsigned char *tile) {
+  int x, y, i;
+
+  for(y=0; y<TILE_SIZE; y++) {
+    for(x=0; x<TILE_SIZE; x++) {
+      i = y * TILE_SIZE + x;
+      if (tx * TILE_SIZE + x < b->w && ty * TILE_SIZE + y < b->h)
+        tile[i] = getpixel(b, tx * TILE_SIZE + x, ty * TILE_SIZE + y);
+      else
+        tile[i] = 0;
     }
-    /* Loop until the current run ends, we reach the limit for a run size
-       (255) or we reach the end of the image data during a run */
-    while(run_val == cur_val && run_count < 255 && pixel_count < b->w * b->h) {
-      pixel_count++;
-      run_count++;
-      cur_val = getpixel(b, (pixel_count % b->w), (pixel_count / b->w));
+  }
+}
+
+/*
+ * tiles_size()
+ *
+ * Returns the number of bytes the tile data of a v3 file (not counting the
+ * index) would take up with the given compression type, or -1 if it can't
+ * be encoded.
+ */
+int tiles_size(BITMAP *b, int compression) {
+  unsigned char tile[TILE_SIZE * TILE_SIZE];
+  int tiles_w, tiles_h, tx, ty, size, total;
+
+  tiles_w = (b->w + TILE_SIZE - 1) / TILE_SIZE;
+  tiles_h = (b->h + TILE_SIZE - 1) / TILE_SIZE;
+  total = 0;
+  for(ty=0; ty<tiles_h; ty++) {
+    for(tx=0; tx<tiles_w; tx++) {
+      get_tile(b, tx, ty, tile);
+      size = plane_size(tile, TILE_SIZE * TILE_SIZE, compression);
+      if (size < 0)
+        return -1;
+      total += size;
     }
-    /* The size of the RLE block increases by 1 for single instances, and 2
-     * for runs (one byte for run flag + color, one byte for run length) */
-    if(run_count > 1) {
-      size+=2;
-    } else {
-      size++;
+  }
+
+  return total;
+}
+
+/*
+ * write_tiles()
+ *
+ * Writes the tile index and tile data of a v3 file.
+ */
+void write_tiles(FILE *fp, BITMAP *b, int compression) {
+  unsigned char tile[TILE_SIZE * TILE_SIZE];
+  unsigned int *offsets;
+  int tiles_w, tiles_h, num_tiles, tx, ty;
+  long index_pos;
+
+  tiles_w = (b->w + TILE_SIZE - 1) / TILE_SIZE;
+  tiles_h = (b->h + TILE_SIZE - 1) / TILE_SIZE;
+  num_tiles = tiles_w * tiles_h;
+  offsets = (unsigned int *)malloc((num_tiles + 1) * sizeof(unsigned int));
+
+  /* Leave room for the index, and fill it in once the tiles are written */
+  index_pos = ftell(fp);
+  fwrite(offsets, sizeof(unsigned int), num_tiles + 1, fp);
+
+  for(ty=0; ty<tiles_h; ty++) {
+    for(tx=0; tx<tiles_w; tx++) {
+      offsets[ty * tiles_w + tx] = ftell(fp);
+      get_tile(b, tx, ty, tile);
+      write_plane(fp, tile, TILE_SIZE * TILE_SIZE, compression);
     }
-  }  
+  }
+  offsets[num_tiles] = ftell(fp);
 
-  return size;
+  fseek(fp, index_pos, SEEK_SET);
+  fwrite(offsets, sizeof(unsigned int), num_tiles + 1, fp);
+  fseek(fp, 0, SEEK_END);
+  free(offsets);
 }
 
 /*
@@ -108,12 +201,13 @@ int main(int argc, char *argv[]) {
   PALETTE p;
   FILE *fp;
   char *infile, *outfile, *title;
-  int category, pal_size, compression;
-  int i, j, size, cur_val, run_val, run_count, pixel_count, do_rle;
+  unsigned char *pixels;
+  int category, pal_size, compression, tiled, total;
+  int i, none_size, rle_size, lz_size, pic_compression;
 
   if (argc < 7 ) {
     printf("Usage: convert <input_file> <output_file> <category_id> ");
-    printf("<title> <palette_size> <compression>\n");
+    printf("<title> <palette_size> <compression> [tiled]\n");
     printf("  Example: convert image1.pcx image1.pic 0 \"Test Image\" 64 0\n");
     exit(1);
   }
@@ -136,11 +230,15 @@ int main(int argc, char *argv[]) {
   }
 
   compression = atoi(argv[6]);
-  if (compression < 0 || compression > 2) {
-    printf("Invalid compression!  Legal values are 0, 1, or 2.\n");
+  if (compression < 0 || compression > 3) {
+    printf("Invalid compression!  Legal values are 0, 1, 2, or 3.\n");
     exit(1);
   }
 
+  tiled = 0;
+  if (argc > 7)
+    tiled = atoi(argv[7]);
+
   /* Initialize allegro so we can get image and palette functions */
   allegro_init();
 
@@ -161,22 +259,51 @@ int main(int argc, char *argv[]) {
     game_pal[i].b = p[i].b;
   }
 
+  /* Grab the image data, making sure it all fits in the palette */
+  pixels = (unsigned char *)malloc(b->w * b->h);
+  for(i=0; i<b->w * b->h; i++) {
+    pixels[i] = getpixel(b, (i % b->w), (i / b->w));
+    if(pixels[i] >= 64) {
+      printf("Invalid index for palette!  All colors must be ");
+      printf("between 0-63!\n");
+      free(pixels);
+      allegro_exit();
+      exit(1);
+    }
+  }
+
   /* Figure out whether we're doing compression or not */
   if (compression == 0) {
     printf("Creating uncompressed file...\n");
-    do_rle = 0;
+    pic_compression = COMPRESSION_NONE;
   } else if (compression == 1) {
     printf("Creating RLE encoded file...\n");
-    do_rle = 1;
+    pic_compression = COMPRESSION_RLE;
+  } else if (compression == 2) {
+    printf("Creating LZ77 encoded file...\n");
+    pic_compression = COMPRESSION_LZ77;
   } else {
     printf("Autodetecting optimal compression...\n");
-    size = get_rle_size(b);
-    if(size < b->w * b->h) {
-      printf("%d < %d, doing RLE\n", size, (b->w * b->h));
-      do_rle = 1;
+    if (tiled) {
+      none_size = tiles_size(b, COMPRESSION_NONE);
+      rle_size = tiles_size(b, COMPRESSION_RLE);
+      lz_size = tiles_size(b, COMPRESSION_LZ77);
+    } else {
+      none_size = b->w * b->h;
+      rle_size = rle_encoded_size(pixels, b->w * b->h);
+      lz_size = plane_size(pixels, b->w * b->h, COMPRESSION_LZ77);
+    }
+    printf("Uncompressed: %d, RLE: %d, LZ77: %d\n", none_size, 
+           rle_size, lz_size);
+    if(lz_size >= 0 && lz_size < rle_size && lz_size < none_size) {
+      printf("Doing LZ77\n");
+      pic_compression = COMPRESSION_LZ77;
+    } else if(rle_size < none_size) {
+      printf("Doing RLE\n");
+      pic_compression = COMPRESSION_RLE;
     } else {
-      printf("%d > %d, doing uncompressed\n", size, (b->w * b->h));
-      do_rle = 0;
+      printf("Doing uncompressed\n");
+      pic_compression = COMPRESSION_NONE;
     }
   }
 
@@ -203,54 +330,36 @@ int main(int argc, char *argv[]) {
   }
 
   fwrite(&pal_size, sizeof(unsigned char), 1, fp);
-  fwrite(&do_rle, sizeof(unsigned char), 1, fp);
+  fputc(pic_compression, fp);
   for(i=0; i<64; i++) {
     fwrite(&(game_pal[i].r), sizeof(unsigned char), 1, fp);
     fwrite(&(game_pal[i].g), sizeof(unsigned char), 1, fp);
     fwrite(&(game_pal[i].b), sizeof(unsigned char), 1, fp);
   }
-  for(i=0;i<23;i++)
+  if (tiled) {
+    /* No transparency data, then the v3 version, tile size and total
+       number of playable squares */
     fputc(0x00, fp);
-
-  if (do_rle == 0) {
-    /* No compression */
-    for(j=0; j<b->h; j++) {
-      for(i=0; i<b->w; i++) {
-        fputc(getpixel(b, i, j), fp);
-      }
-    }
-  }
-  else {
-    /* Run length encoding */
-    pixel_count = 0;
-    run_count = 0;
-    while(pixel_count < b->w * b->h) {
-      run_count = 0;
-      cur_val = getpixel(b, (pixel_count % b->w), (pixel_count / b->w));
-      run_val = cur_val;
-      if(run_val >=64) {
-        printf("Invalid index for palette!  All colors must be ");
-        printf("between 0-63!\n");
-        fclose(fp);
-        allegro_exit();
-        exit(1);
-      }
-      while(run_val == cur_val && run_count < 255 && 
-            pixel_count < b->w * b->h) {
-        pixel_count++;
-        run_count++;        
-        cur_val = getpixel(b, (pixel_count % b->w), (pixel_count / b->w));
-      }
-      if(run_count > 1) {
-        fputc(0x80 | run_val, fp);
-        fputc(run_count, fp);
-      } else {
-        fputc(run_val, fp);
-      }
-    }
+    fputc(0x00, fp);
+    fputc(0x00, fp);
+    fputc(3, fp);
+    fputc(TILE_SHIFT, fp);
+    total = b->w * b->h;
+    fwrite(&total, sizeof(int), 1, fp);
+    for(i=0;i<14;i++)
+      fputc(0x00, fp);
+  } else {
+    for(i=0;i<23;i++)
+      fputc(0x00, fp);
   }
 
+  if (tiled)
+    write_tiles(fp, b, pic_compression);
+  else
+    write_plane(fp, pixels, b->w * b->h, pic_compression);
+
   fclose(fp);
+  free(pixels);
 
   printf("Wrote %s\n", outfile);
   allegro_exit();